@@ -1,6 +1,31 @@
+#include <algorithm>
+
 #include "AiPlayer.hpp"
 
-AiPlayer::AiPlayer(int id, int o_id) : Player(id), opponent_id(o_id) {
+namespace {
+    //the score of a won game, estimates always stay strictly inside it
+    const int WIN_SCORE = 100;
+
+    //the budget of the proof-number solver used in the endgame
+    const unsigned int SOLVER_NODES = 100000;
+    const unsigned int SOLVER_EXPANSIONS = 100000;
+
+    //the maximum number of threats in a forcing sequence
+    const unsigned int THREAT_DEPTH = 4;
+}
+
+/**
+ * @param int id the computer's id
+ * @param int o_id the opponent's id
+ * @param unsigned int d the maximum search depth, 0 searches to the end, it is
+ * only used once the evaluator's weights are loaded
+ * @param unsigned int e the number of empty cells from which on the
+ * proof-number solver is tried before minimax, 0 never uses it
+ */
+AiPlayer::AiPlayer(int id, int o_id, unsigned int d, unsigned int e)
+    : Player(id), opponent_id(o_id), max_depth(d), trained(false),
+    endgame_cells(e), solver(SOLVER_NODES, SOLVER_EXPANSIONS),
+    threat_search(THREAT_DEPTH) {
 }
 
 /**
@@ -14,9 +39,37 @@ AiPlayer::AiPlayer(int id, int o_id) : Player(id), opponent_id(o_id) {
  * on the board where the computer's move should be made
  */
 std::pair<unsigned int, unsigned int> AiPlayer::GetInput(sf::Event, Board b){
+    std::pair<unsigned int, unsigned int> move;
+    std::vector< std::pair<unsigned int, unsigned int> > sequence;
+
+    // a forcing sequence of threats is the quickest way to win
+    if(b.GetThreats(opponent_id).empty()
+        && threat_search.Search(b, id, opponent_id, sequence)){
+        return sequence[0];
+    }
+
+    if(b.GetPossibleMoves().size() <= endgame_cells && Endgame(b, move)){
+        return move;
+    }
+
     return Minimax(b);
 }
 
+/**
+ * Load the evaluator's weights used to score the boards where the search stops
+ *
+ * @param std::string file the weights file written by the trainer
+ *
+ * @return bool true if the weights were loaded, else false and the search
+ * keeps going to the end since an untrained evaluator can't score the boards
+ * where it would stop
+ */
+bool AiPlayer::LoadEvaluator(const std::string &file){
+    trained = evaluator.Load(file) || trained;
+
+    return trained;
+}
+
 /**
  * Calculate the score for the winner player
  *
@@ -24,39 +77,122 @@ std::pair<unsigned int, unsigned int> AiPlayer::GetInput(sf::Event, Board b){
  *
  * @param int winner the player whose score should be calculated
  *
- * @return int 1 for the maximizing player (the computer),
- * -1 for the minimizing player(the opponent) or 0 for a draw
+ * @return int WIN_SCORE for the maximizing player (the computer),
+ * -WIN_SCORE for the minimizing player(the opponent) or 0 for a draw
  */
 int AiPlayer::GetScore(int winner){
     if(winner == id){
         // the maximizing (AiPlayer) player won
-        return  1;
+        return WIN_SCORE;
     }
 
     if(winner == opponent_id){
         // the minimizing (the opponent) player won
-        return -1;
+        return -WIN_SCORE;
     }
 
     // it's a draw
     return 0;
 }
 
+/**
+ * Estimate the score of a board where the game is not over yet
+ *
+ * This is used in minimax when the maximum depth is reached. The evaluator
+ * is trained on afterstates, so it values a board for the player that just
+ * moved on it
+ *
+ * @param Board b the board that should be estimated
+ * @param int mover the player that made the last move on the board
+ *
+ * @return int a score strictly between -WIN_SCORE and WIN_SCORE, from the
+ * maximizing player's (the computer's) point of view
+ */
+int AiPlayer::GetEstimate(const Board &b, int mover){
+    float value;
+
+    if(mover == id){
+        value = evaluator.Evaluate(b, id, opponent_id);
+    }
+    else{
+        value = -evaluator.Evaluate(b, opponent_id, id);
+    }
+
+    return static_cast<int>(value * (WIN_SCORE - 1));
+}
+
+/**
+ * Get the moves worth searching for a player, threat moves first
+ *
+ * If the player can win right away only the winning move is kept, if the
+ * opponent threatens to win only the blocking moves are kept since any other
+ * move loses, otherwise every move is kept but the ones that make a threat
+ * are searched first
+ *
+ * @param Board b the board where the player is to move
+ * @param int player the player to move
+ * @param int opponent the player's opponent
+ *
+ * @return std::vector< std::pair<unsigned int, unsigned int> > the moves
+ * (row, col) that should be searched, in the order they should be searched
+ */
+std::vector< std::pair<unsigned int, unsigned int> > AiPlayer::GetCandidateMoves(
+        Board &b, int player, int opponent){
+    std::vector< std::pair<unsigned int, unsigned int> > moves = b.GetThreats(player);
+
+    if(!moves.empty()){
+        moves.resize(1);
+        return moves;
+    }
+
+    moves = b.GetThreats(opponent);
+
+    if(!moves.empty()){
+        return moves;
+    }
+
+    moves = b.GetPossibleMoves();
+    std::vector< std::pair<unsigned int, unsigned int> > quiet;
+    std::vector< std::pair<unsigned int, unsigned int> >::iterator it;
+    unsigned int threats = 0;
+
+    for(it = moves.begin(); it != moves.end(); it++){
+        b.Update(player, it->first, it->second);
+
+        if(b.GetThreats(player).empty()){
+            quiet.push_back(*it);
+        }
+        else{
+            moves[threats++] = *it;
+        }
+
+        b.Reset(it->first, it->second);
+    }
+
+    std::copy(quiet.begin(), quiet.end(), moves.begin() + threats);
+
+    return moves;
+}
+
 /**
  * Get the best move from the maximizing player's point of view
  *
  * @param Board b the current board that is to be analysed
+ * @param unsigned int depth the number of moves made since the search started
+ * @param int alpha the score the maximizing player is already sure of
+ * @param int beta the score the minimizing player is already sure of
  *
  * @return std::pair<int, std::pair<unsigned int, unsigned int> > a pair of
  * score and the starting move that leads to that score (the move is itself a
  * pair made of the row and column of the move)
  */
-std::pair<int, std::pair<unsigned int, unsigned int> > AiPlayer::Max(Board b){
-    int best_score = -1;
+std::pair<int, std::pair<unsigned int, unsigned int> > AiPlayer::Max(Board b,
+        unsigned int depth, int alpha, int beta){
+    int best_score = -WIN_SCORE - 1;
     int score;
     std::pair<unsigned int, unsigned int> best_move;
 
-    std::vector< std::pair<unsigned int, unsigned int> > moves = b.GetPossibleMoves();
+    std::vector< std::pair<unsigned int, unsigned int> > moves = GetCandidateMoves(b, id, opponent_id);
     std::vector< std::pair<unsigned int, unsigned int> >::iterator it;
 
     // iterate through the child nodes
@@ -67,8 +203,12 @@ std::pair<int, std::pair<unsigned int, unsigned int> > AiPlayer::Max(Board b){
         if(winner != 0){ //the gamne is over
             score = GetScore(winner);
         }
+        else if(trained && max_depth != 0 && depth + 1 >= max_depth){
+            // the search is deep enough, estimate instead of going deeper
+            score = GetEstimate(b, id);
+        }
         else{ // the game continues and it's the minimizing player's turn
-            score = Min(b).first;
+            score = Min(b, depth + 1, alpha, beta).first;
         }
 
         // undo the move so we get the same board that was passed as argument
@@ -80,6 +220,14 @@ std::pair<int, std::pair<unsigned int, unsigned int> > AiPlayer::Max(Board b){
             best_score = score;
             best_move = std::make_pair(it->first, it->second);
         }
+
+        // the minimizing player won't let the game get here, the remaining
+        // children don't matter
+        if(best_score >= beta){
+            break;
+        }
+
+        alpha = std::max(alpha, best_score);
     }
 
     // after visiting all children return the best score and the move
@@ -91,17 +239,21 @@ std::pair<int, std::pair<unsigned int, unsigned int> > AiPlayer::Max(Board b){
  * Get the best move from the minimizing player's point of view
  *
  * @param Board b the current board that is to be analysed
+ * @param unsigned int depth the number of moves made since the search started
+ * @param int alpha the score the maximizing player is already sure of
+ * @param int beta the score the minimizing player is already sure of
  *
  * @return std::pair<int, std::pair<unsigned int, unsigned int> > a pair of
  * score and the starting move that leads to that score (the move is itself a
  * pair made of the row and column of the move)
  */
-std::pair<int, std::pair<unsigned int, unsigned int> > AiPlayer::Min(Board b){
-    int best_score = 1;
+std::pair<int, std::pair<unsigned int, unsigned int> > AiPlayer::Min(Board b,
+        unsigned int depth, int alpha, int beta){
+    int best_score = WIN_SCORE + 1;
     int score;
     std::pair<unsigned int, unsigned int> best_move;
 
-    std::vector< std::pair<unsigned int, unsigned int> > moves = b.GetPossibleMoves();
+    std::vector< std::pair<unsigned int, unsigned int> > moves = GetCandidateMoves(b, opponent_id, id);
     std::vector< std::pair<unsigned int, unsigned int> >::iterator it;
 
     // iterate through the child nodes
@@ -112,8 +264,12 @@ std::pair<int, std::pair<unsigned int, unsigned int> > AiPlayer::Min(Board b){
         if(winner != 0){ //the game is over
             score = GetScore(winner);
         }
+        else if(trained && max_depth != 0 && depth + 1 >= max_depth){
+            // the search is deep enough, estimate instead of going deeper
+            score = GetEstimate(b, opponent_id);
+        }
         else{ // the game continues and it's the maximizing player's turn
-            score = Max(b).first;
+            score = Max(b, depth + 1, alpha, beta).first;
         }
 
         // undo the move so we get the same board that was passed as argument
@@ -125,6 +281,14 @@ std::pair<int, std::pair<unsigned int, unsigned int> > AiPlayer::Min(Board b){
             best_score = score;
             best_move = std::make_pair(it->first, it->second);
         }
+
+        // the maximizing player won't let the game get here, the remaining
+        // children don't matter
+        if(best_score <= alpha){
+            break;
+        }
+
+        beta = std::min(beta, best_score);
     }
 
     // after visiting all children return the best score and the move
@@ -137,7 +301,10 @@ std::pair<int, std::pair<unsigned int, unsigned int> > AiPlayer::Min(Board b){
  * of view
  *
  * We are starting from the computer's point of view because the algorithm is
- * used when is computer's turn to move
+ * used when is computer's turn to move, if a maximum depth was given the
+ * boards where the search stops are scored by the evaluator. Branches that
+ * can't change the result are cut off (alpha-beta pruning), so searching the
+ * threat moves first pays off
  *
  * @param Board b the current board that should be analysed
  *
@@ -145,5 +312,36 @@ std::pair<int, std::pair<unsigned int, unsigned int> > AiPlayer::Min(Board b){
  * composed of the row and the column
  */
 std::pair<unsigned int, unsigned int> AiPlayer::Minimax(Board b){
-    return Max(b).second;
+    return Max(b, 0, -WIN_SCORE - 1, WIN_SCORE + 1).second;
+}
+
+/**
+ * Try to solve the current board with the proof-number solver
+ *
+ * First a forced win for the computer is searched for, if there's none then
+ * a move that surely doesn't lose
+ *
+ * @param Board b the current board that should be solved
+ * @param std::pair<unsigned int, unsigned int> move where the chosen move is
+ * stored (row and column)
+ *
+ * @return bool true if a move was found, false if the solver couldn't find
+ * one within its budget (or every move loses) and minimax should decide
+ */
+bool AiPlayer::Endgame(Board b, std::pair<unsigned int, unsigned int> &move){
+    SolverResult result = solver.Solve(b, id, opponent_id, id);
+
+    if(result.status == SolverResult::Proven){
+        move = result.move;
+        return true;
+    }
+
+    result = solver.Solve(b, opponent_id, id, id);
+
+    if(result.status == SolverResult::Disproven){
+        move = result.move;
+        return true;
+    }
+
+    return false;
 }
@@ -4,20 +4,36 @@
 #include <SFML/Window.hpp>
 
 #include "Player.hpp"
+#include "Evaluator.hpp"
+#include "ProofNumberSolver.hpp"
+#include "ThreatSpaceSearch.hpp"
 
 class AiPlayer : public Player {
     public:
-        AiPlayer(int id, int o_id);
+        AiPlayer(int id, int o_id, unsigned int d=0, unsigned int e=0);
         std::pair<unsigned int, unsigned int> GetInput(sf::Event, Board b);
+        bool LoadEvaluator(const std::string &file);
 
     protected:
         int GetScore(int winner);
-        std::pair<int, std::pair<unsigned int, unsigned int> > Max(Board b);
-        std::pair<int, std::pair<unsigned int, unsigned int> > Min(Board b);
+        int GetEstimate(const Board &b, int mover);
+        std::vector< std::pair<unsigned int, unsigned int> > GetCandidateMoves(
+                Board &b, int player, int opponent);
+        std::pair<int, std::pair<unsigned int, unsigned int> > Max(Board b,
+                unsigned int depth, int alpha, int beta);
+        std::pair<int, std::pair<unsigned int, unsigned int> > Min(Board b,
+                unsigned int depth, int alpha, int beta);
         std::pair<unsigned int, unsigned int> Minimax(Board b);
+        bool Endgame(Board b, std::pair<unsigned int, unsigned int> &move);
 
     private:
         int opponent_id;
+        unsigned int max_depth;
+        bool trained;
+        unsigned int endgame_cells;
+        Evaluator evaluator;
+        ProofNumberSolver solver;
+        ThreatSpaceSearch threat_search;
 };
 
 #endif
@@ -1,10 +1,19 @@
+#include <algorithm>
+
 #include "Board.hpp"
 
+namespace {
+    //the owner of a line that holds the marks of both players
+    const int MIXED = -2;
+}
+
 Board::Board(unsigned int w, unsigned int h, int e)
-            : board(3, std::vector<int>(3, e)) {
+            : board(3, std::vector<int>(3, e)), lines(8) {
     width = w;
     height = h;
     empty = e;
+
+    Reset();
 }
 
 /**
@@ -35,6 +44,19 @@ std::pair<unsigned int, unsigned int> Board::CoordToPos(unsigned int x,
     return std::pair<unsigned int, unsigned int>(row, col);
 }
 
+/**
+ * Get the marker found at a position on the board
+ *
+ * @param unsigned int row the row of the position
+ * @param unsigned int col the column of the position
+ *
+ * @return int the player's id that marked the position or the empty marker
+ */
+int Board::Get(unsigned int row, unsigned int col) const {
+    //Note: the vector is 0-indexed
+    return board[row-1][col-1];
+}
+
 /**
  * Mark a position on the board with the player's id
  *
@@ -50,6 +72,7 @@ bool Board::Update(int id, unsigned int row, unsigned int col){
     if(IsValidMove(row, col)){
         //Note: the vector is 0-indexed
         board[row-1][col-1] = id;
+        UpdateLines(row, col);
 
         return true;
     }
@@ -112,6 +135,11 @@ void Board::Reset(){
     for(int i=0; i<board.capacity(); i++){
         std::fill(board[i].begin(), board[i].end(), empty);
     }
+
+    for(unsigned int i=0; i<lines.size(); i++){
+        lines[i].marks = 0;
+        lines[i].owner = empty;
+    }
 }
 
 /**
@@ -126,6 +154,7 @@ bool Board::Reset(unsigned int row, unsigned int col){
     if(IsValidRowCol(row, col)){
         //Note: the vector is 0-indexed
         board[row-1][col-1] = empty;
+        UpdateLines(row, col);
         return true;
     }
 
@@ -145,6 +174,38 @@ std::vector< std::pair<unsigned int, unsigned int> > Board::GetPossibleMoves(){
     return x;
 }
 
+/**
+ * Get the threats of a player
+ *
+ * A threat is an empty position that would complete a line of the player,
+ * these are found using the lines' state kept up to date by every move
+ *
+ * @param int id the player whose threats are wanted
+ *
+ * @return std::vector< std::pair<unsigned int, unsigned int> > the distinct
+ * positions (row, col) where the player would win by moving
+ */
+std::vector< std::pair<unsigned int, unsigned int> > Board::GetThreats(int id){
+    std::vector< std::pair<unsigned int, unsigned int> > x;
+
+    for(unsigned int i=0; i<lines.size(); i++){
+        if(lines[i].owner != id || lines[i].marks != 2){
+            continue;
+        }
+
+        for(unsigned int j=0; j<3; j++){
+            std::pair<unsigned int, unsigned int> cell = GetLineCell(i, j);
+
+            if(board[cell.first-1][cell.second-1] == empty
+                && std::find(x.begin(), x.end(), cell) == x.end()){
+                x.push_back(cell);
+            }
+        }
+    }
+
+    return x;
+}
+
 /**
  * Check if the given position is within the board
  *
@@ -178,3 +239,74 @@ bool Board::IsValidMove(unsigned int row, unsigned int col){
 
     return false;
 }
+
+/**
+ * Recount the lines passing through a position after it changed
+ *
+ * Only the (at most 4) lines through the position are touched so keeping
+ * the threats up to date is cheap
+ *
+ * @param unsigned int row the row of the position that changed
+ * @param unsigned int col the column of the position that changed
+ */
+void Board::UpdateLines(unsigned int row, unsigned int col){
+    //rows come first, then columns, then the two diagonals
+    unsigned int through[4];
+    unsigned int count = 0;
+
+    through[count++] = row - 1;
+    through[count++] = 3 + col - 1;
+
+    if(row == col){
+        through[count++] = 6;
+    }
+
+    if(row + col == 4){
+        through[count++] = 7;
+    }
+
+    for(unsigned int i=0; i<count; i++){
+        Line &line = lines[through[i]];
+        line.marks = 0;
+        line.owner = empty;
+
+        for(unsigned int j=0; j<3; j++){
+            std::pair<unsigned int, unsigned int> cell = GetLineCell(through[i], j);
+            int marker = board[cell.first-1][cell.second-1];
+
+            if(marker == empty){
+                continue;
+            }
+
+            line.owner = (line.marks == 0 || line.owner == marker) ?
+                marker : MIXED;
+            line.marks++;
+        }
+    }
+}
+
+/**
+ * Get a position on one of the lines of the board
+ *
+ * @param unsigned int line the line: 0-2 are the rows, 3-5 the columns, 6 the
+ * first diagonal and 7 the second one
+ * @param unsigned int i the index of the position on the line (0-2)
+ *
+ * @return std::pair<unsigned int, unsigned int> the position's row and column
+ */
+std::pair<unsigned int, unsigned int> Board::GetLineCell(unsigned int line,
+        unsigned int i) const {
+    if(line < 3){
+        return std::make_pair(line + 1, i + 1);
+    }
+
+    if(line < 6){
+        return std::make_pair(i + 1, line - 3 + 1);
+    }
+
+    if(line == 6){
+        return std::make_pair(i + 1, i + 1);
+    }
+
+    return std::make_pair(i + 1, 3 - i);
+}
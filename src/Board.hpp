@@ -11,8 +11,10 @@ class Board{
         void Reset();
         bool Reset(unsigned int row, unsigned int col);
         std::vector< std::pair<unsigned int, unsigned int> > GetPossibleMoves();
+        std::vector< std::pair<unsigned int, unsigned int> > GetThreats(int id);
         std::pair<unsigned int, unsigned int> CoordToPos(unsigned int x,
                 unsigned int y) const;
+        int Get(unsigned int row, unsigned int col) const;
 
         unsigned int GetWidth(){
             return width;
@@ -25,11 +27,20 @@ class Board{
     protected:
         bool IsValidRowCol(unsigned int row, unsigned int col);
         bool IsValidMove(unsigned int row, unsigned int col);
+        void UpdateLines(unsigned int row, unsigned int col);
+        std::pair<unsigned int, unsigned int> GetLineCell(unsigned int line,
+                unsigned int i) const;
 
     private:
+        struct Line{
+            unsigned int marks;
+            int owner;
+        };
+
         unsigned int width, height;
         int empty;
         std::vector< std::vector<int> > board;
+        std::vector<Line> lines;
 };
 
 #endif
@@ -0,0 +1,183 @@
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#include "Evaluator.hpp"
+
+namespace {
+    //every tuple is one line of the board (3 rows, 3 columns, 2 diagonals)
+    const unsigned int TUPLE_COUNT = 8;
+    const unsigned int TUPLE_SIZE = 3;
+
+    //each cell is empty, own or opponent's, so a tuple has 3^3 states
+    const unsigned int TUPLE_ENTRIES = 27;
+
+    //the (row, col) pairs of the cells sampled by each tuple
+    const unsigned int TUPLES[TUPLE_COUNT][TUPLE_SIZE][2] = {
+        {{1, 1}, {1, 2}, {1, 3}},
+        {{2, 1}, {2, 2}, {2, 3}},
+        {{3, 1}, {3, 2}, {3, 3}},
+        {{1, 1}, {2, 1}, {3, 1}},
+        {{1, 2}, {2, 2}, {3, 2}},
+        {{1, 3}, {2, 3}, {3, 3}},
+        {{1, 1}, {2, 2}, {3, 3}},
+        {{1, 3}, {2, 2}, {3, 1}}
+    };
+
+    const char MAGIC[4] = {'T', 'T', 'T', 'W'};
+}
+
+Evaluator::Evaluator() : weights(TUPLE_COUNT * TUPLE_ENTRIES, 0.f) {
+}
+
+/**
+ * Estimate the outcome of the game from a player's point of view
+ *
+ * The estimate is the sum of the weights looked up by every tuple passed
+ * through tanh, so a value close to 1 means the player is likely to win
+ * and one close to -1 means the opponent is likely to win
+ *
+ * @param Board b the board that should be evaluated
+ * @param int id the player from whose point of view the board is evaluated
+ * @param int o_id the opponent's id
+ *
+ * @return float the estimated outcome, between -1 and 1
+ */
+float Evaluator::Evaluate(const Board &b, int id, int o_id) const {
+    unsigned int indices[TUPLE_COUNT];
+
+    GetIndices(b, id, o_id, indices);
+
+    return std::tanh(Sum(indices));
+}
+
+/**
+ * Move the estimate of a board towards a target value
+ *
+ * This is one gradient descent step on the squared error between the
+ * estimate and the target, used by the temporal-difference training
+ *
+ * @param Board b the board whose estimate should be updated
+ * @param int id the player from whose point of view the board is evaluated
+ * @param int o_id the opponent's id
+ * @param float target the value the estimate should move towards
+ * @param float alpha the learning rate
+ */
+void Evaluator::Update(const Board &b, int id, int o_id, float target,
+        float alpha){
+    unsigned int indices[TUPLE_COUNT];
+
+    GetIndices(b, id, o_id, indices);
+
+    float value = std::tanh(Sum(indices));
+    float delta = alpha * (target - value) * (1 - value * value);
+
+    for(unsigned int i=0; i<TUPLE_COUNT; i++){
+        weights[indices[i]] += delta;
+    }
+}
+
+/**
+ * Load the weights from a binary file
+ *
+ * The file starts with a 4 bytes magic number, followed by the number of
+ * weights as an unsigned int and the weights themselves as floats
+ *
+ * @param std::string file the path of the file
+ *
+ * @return bool true if the weights were loaded, false if the file couldn't
+ * be read or it doesn't match this evaluator, in which case the current
+ * weights are kept
+ */
+bool Evaluator::Load(const std::string &file){
+    std::ifstream in(file.c_str(), std::ios::in | std::ios::binary);
+    char magic[4];
+    unsigned int count;
+
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&count), sizeof(count));
+
+    if(!in || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0
+        || count != weights.size()){
+        return false;
+    }
+
+    std::vector<float> w(count);
+    in.read(reinterpret_cast<char*>(&w[0]), count * sizeof(float));
+
+    if(!in){
+        return false;
+    }
+
+    weights.swap(w);
+    return true;
+}
+
+/**
+ * Save the weights to a binary file, see Load() for the format
+ *
+ * @param std::string file the path of the file
+ *
+ * @return bool true if the weights were written, else false
+ */
+bool Evaluator::Save(const std::string &file) const {
+    std::ofstream out(file.c_str(), std::ios::out | std::ios::binary);
+    unsigned int count = weights.size();
+
+    out.write(MAGIC, sizeof(MAGIC));
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    out.write(reinterpret_cast<const char*>(&weights[0]),
+            count * sizeof(float));
+
+    return out.good();
+}
+
+/**
+ * Compute the weight looked up by each tuple for the given board
+ *
+ * Cells are encoded relative to the player (0 empty, 1 own, 2 opponent's) so
+ * the same weights serve both players
+ *
+ * @param Board b the board that is sampled
+ * @param int id the player from whose point of view the board is sampled
+ * @param int o_id the opponent's id
+ * @param unsigned int* indices an array of TUPLE_COUNT elements where the
+ * index into the weights of each tuple is stored
+ */
+void Evaluator::GetIndices(const Board &b, int id, int o_id,
+        unsigned int *indices) const {
+    for(unsigned int i=0; i<TUPLE_COUNT; i++){
+        unsigned int index = 0;
+
+        for(unsigned int j=0; j<TUPLE_SIZE; j++){
+            int cell = b.Get(TUPLES[i][j][0], TUPLES[i][j][1]);
+
+            index *= 3;
+            if(cell == id){
+                index += 1;
+            }
+            else if(cell == o_id){
+                index += 2;
+            }
+        }
+
+        indices[i] = i * TUPLE_ENTRIES + index;
+    }
+}
+
+/**
+ * Add up the weights found at the given indices
+ *
+ * @param unsigned int* indices the TUPLE_COUNT indices into the weights
+ *
+ * @return float the sum of the weights
+ */
+float Evaluator::Sum(const unsigned int *indices) const {
+    float sum = 0;
+
+    for(unsigned int i=0; i<TUPLE_COUNT; i++){
+        sum += weights[indices[i]];
+    }
+
+    return sum;
+}
@@ -0,0 +1,27 @@
+#ifndef EVALUATOR_HPP_GUARD
+#define EVALUATOR_HPP_GUARD
+
+#include <string>
+#include <vector>
+
+#include "Board.hpp"
+
+class Evaluator{
+    public:
+        Evaluator();
+        float Evaluate(const Board &b, int id, int o_id) const;
+        void Update(const Board &b, int id, int o_id, float target,
+                float alpha);
+        bool Load(const std::string &file);
+        bool Save(const std::string &file) const;
+
+    protected:
+        void GetIndices(const Board &b, int id, int o_id,
+                unsigned int *indices) const;
+        float Sum(const unsigned int *indices) const;
+
+    private:
+        std::vector<float> weights;
+};
+
+#endif
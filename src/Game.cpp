@@ -3,7 +3,7 @@
 Game::Game(unsigned int w, unsigned h, const std::string& t)
     : status_area_height(30), board(w, h-status_area_height),
     window(sf::VideoMode(w, h, 32), t, sf::Style::Close),
-    input(window.GetInput()), human(1), ai(2, 1) {
+    input(window.GetInput()), human(1), ai(2, 1, 0, 5) {
     title = t;
     height = h;
 }
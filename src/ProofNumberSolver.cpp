@@ -0,0 +1,420 @@
+#include <algorithm>
+
+#include "ProofNumberSolver.hpp"
+
+namespace {
+    //proof and disproof numbers saturate at this value
+    const unsigned int INF = 1u << 30;
+
+    //the root always lives in the first slot of the node table
+    const unsigned int ROOT = 0;
+
+    unsigned int SaturatingAdd(unsigned int a, unsigned int b){
+        return (a >= INF || b >= INF || a + b >= INF) ? INF : a + b;
+    }
+}
+
+/**
+ * @param unsigned int m the maximum number of nodes kept in the node table
+ * @param unsigned int e the maximum number of node expansions per Solve()
+ */
+ProofNumberSolver::ProofNumberSolver(unsigned int m, unsigned int e)
+    : max_nodes(m), max_expansions(e) {
+}
+
+/**
+ * Try to prove that the attacker can force a win from the given position
+ *
+ * This is a best-first proof-number search: the most proving node is
+ * repeatedly expanded until the root is proven (the attacker wins),
+ * disproven (the defender can hold a draw or win) or the expansion budget
+ * runs out. When the node table is full it is garbage collected, see
+ * CollectGarbage()
+ *
+ * @param Board b the position that should be solved
+ * @param int attacker the player that tries to win
+ * @param int defender the attacker's opponent
+ * @param int to_move the player whose turn it is on the given board
+ *
+ * @return SolverResult the status of the root, the size of the proof or
+ * disproof tree, the number of expansions made and, if the player to move
+ * has one, the move that realizes the result (otherwise (0, 0))
+ */
+SolverResult ProofNumberSolver::Solve(Board b, int attacker, int defender,
+        int to_move){
+    SolverResult result;
+    result.status = SolverResult::Unknown;
+    result.solution_size = 0;
+    result.expansions = 0;
+    result.move = std::make_pair(0, 0);
+
+    nodes.clear();
+    free_nodes.clear();
+
+    if(max_nodes == 0){
+        return result;
+    }
+
+    NewNode(ROOT, to_move == attacker, std::make_pair(0, 0));
+
+    int winner = b.GetWinner();
+    if(winner != 0){
+        nodes[ROOT].proof = winner == attacker ? 0 : INF;
+        nodes[ROOT].disproof = winner == attacker ? INF : 0;
+        nodes[ROOT].size = 1;
+    }
+
+    while(nodes[ROOT].proof != 0 && nodes[ROOT].disproof != 0
+            && result.expansions < max_expansions){
+        Board current = b;
+        unsigned int n = SelectMostProving(current, attacker, defender);
+        unsigned int needed = current.GetPossibleMoves().size()
+            - nodes[n].children.size();
+
+        if(FreeSlots() < needed){
+            //the path to the most proving node is kept, so it can be
+            //expanded right after the collection
+            CollectGarbage(needed, n);
+
+            if(FreeSlots() < needed){
+                //the budget is too small to go on
+                break;
+            }
+        }
+
+        Expand(n, current, attacker, defender);
+        UpdateAncestors(n);
+        result.expansions++;
+    }
+
+    const Node &root = nodes[ROOT];
+
+    if(root.proof == 0){
+        result.status = SolverResult::Proven;
+    }
+    else if(root.disproof == 0){
+        result.status = SolverResult::Disproven;
+    }
+    else{
+        return result;
+    }
+
+    result.solution_size = root.size;
+
+    //the player to move realizes the result through a solved child: the
+    //attacker through a proven one, the defender through a disproven one
+    for(unsigned int i=0; i<root.children.size(); i++){
+        const Node &child = nodes[root.children[i]];
+
+        if((root.or_node && child.proof == 0)
+            || (!root.or_node && child.disproof == 0)){
+            result.move = child.move;
+            break;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Take a slot from the node table and initialize it as an unexpanded leaf
+ *
+ * @param unsigned int parent the parent's slot, the root is its own parent
+ * @param bool or_node true if the attacker is to move in this node
+ * @param std::pair<unsigned int, unsigned int> move the move that leads from
+ * the parent to this node
+ *
+ * @return unsigned int the slot of the new node
+ */
+unsigned int ProofNumberSolver::NewNode(unsigned int parent, bool or_node,
+        std::pair<unsigned int, unsigned int> move){
+    unsigned int n;
+
+    if(!free_nodes.empty()){
+        n = free_nodes.back();
+        free_nodes.pop_back();
+    }
+    else{
+        n = nodes.size();
+        nodes.push_back(Node());
+    }
+
+    Node &node = nodes[n];
+    node.proof = 1;
+    node.disproof = 1;
+    node.size = 0;
+    node.parent = parent;
+    node.depth = (n == parent) ? 0 : nodes[parent].depth + 1;
+    node.move = move;
+    node.or_node = or_node;
+    node.expanded = false;
+    node.children.clear();
+
+    return n;
+}
+
+/**
+ * Return every descendant of a node to the free list, the node keeps its
+ * proof and disproof numbers and becomes a leaf again
+ *
+ * @param unsigned int n the node whose subtree is freed
+ */
+void ProofNumberSolver::FreeChildren(unsigned int n){
+    for(unsigned int i=0; i<nodes[n].children.size(); i++){
+        unsigned int child = nodes[n].children[i];
+
+        FreeChildren(child);
+        free_nodes.push_back(child);
+    }
+
+    nodes[n].children.clear();
+    nodes[n].expanded = false;
+}
+
+/**
+ * Turn an unsolved node back into a leaf
+ *
+ * The node keeps its proof and disproof numbers and its solved children
+ * (as leaves), those don't have to be solved again when the node is
+ * expanded again, the unsolved children are freed
+ *
+ * @param unsigned int n the node that should be collapsed
+ */
+void ProofNumberSolver::Collapse(unsigned int n){
+    std::vector<unsigned int> kept;
+
+    for(unsigned int i=0; i<nodes[n].children.size(); i++){
+        unsigned int child = nodes[n].children[i];
+
+        FreeChildren(child);
+
+        if(nodes[child].proof == 0 || nodes[child].disproof == 0){
+            kept.push_back(child);
+        }
+        else{
+            free_nodes.push_back(child);
+        }
+    }
+
+    nodes[n].children.swap(kept);
+    nodes[n].expanded = false;
+}
+
+/**
+ * Make room in the node table
+ *
+ * First the subtrees of solved nodes are dropped since their result (and
+ * solution size) is already known. If that doesn't free half of the table,
+ * unsolved nodes are collapsed starting with the deepest ones, see
+ * Collapse(). The path from the root to the selected node is never
+ * collapsed, otherwise the search would redo the same work over and over
+ *
+ * @param unsigned int needed the minimum number of free slots wanted
+ * @param unsigned int selected the node that is about to be expanded
+ */
+void ProofNumberSolver::CollectGarbage(unsigned int needed,
+        unsigned int selected){
+    unsigned int wanted = std::max(needed, max_nodes / 2);
+    unsigned int max_depth = 0;
+    std::vector<unsigned int> stack(1, ROOT);
+    std::vector<bool> on_path(nodes.size(), false);
+
+    for(unsigned int n=selected; n!=ROOT; n=nodes[n].parent){
+        on_path[n] = true;
+    }
+
+    on_path[ROOT] = true;
+
+    while(!stack.empty()){
+        unsigned int n = stack.back();
+        stack.pop_back();
+
+        if(nodes[n].proof == 0 || nodes[n].disproof == 0){
+            FreeChildren(n);
+            continue;
+        }
+
+        if(nodes[n].expanded){
+            max_depth = std::max(max_depth, nodes[n].depth);
+            stack.insert(stack.end(), nodes[n].children.begin(),
+                    nodes[n].children.end());
+        }
+    }
+
+    for(unsigned int depth=max_depth; depth>0 && FreeSlots()<wanted; depth--){
+        stack.assign(1, ROOT);
+
+        while(!stack.empty()){
+            unsigned int n = stack.back();
+            stack.pop_back();
+
+            if(nodes[n].depth == depth){
+                if(nodes[n].expanded && !on_path[n]){
+                    Collapse(n);
+                }
+            }
+            else if(nodes[n].expanded){
+                stack.insert(stack.end(), nodes[n].children.begin(),
+                        nodes[n].children.end());
+            }
+        }
+    }
+}
+
+/**
+ * Walk from the root to the most proving node
+ *
+ * In OR nodes the child with the smallest proof number is followed, in AND
+ * nodes the one with the smallest disproof number
+ *
+ * @param Board b the root position, the moves on the path are applied to it
+ * @param int attacker the player that tries to win
+ * @param int defender the attacker's opponent
+ *
+ * @return unsigned int the most proving node, an unexpanded leaf
+ */
+unsigned int ProofNumberSolver::SelectMostProving(Board &b, int attacker,
+        int defender){
+    unsigned int n = ROOT;
+
+    while(nodes[n].expanded){
+        const Node &node = nodes[n];
+        unsigned int best = node.children[0];
+
+        for(unsigned int i=1; i<node.children.size(); i++){
+            const Node &child = nodes[node.children[i]];
+
+            if(node.or_node ? child.proof < nodes[best].proof
+                : child.disproof < nodes[best].disproof){
+                best = node.children[i];
+            }
+        }
+
+        b.Update(node.or_node ? attacker : defender, nodes[best].move.first,
+                nodes[best].move.second);
+        n = best;
+    }
+
+    return n;
+}
+
+/**
+ * Generate the children of a leaf, finished games are solved right away
+ *
+ * A collapsed node still has its solved children, only the missing ones
+ * are generated
+ *
+ * @param unsigned int n the leaf that should be expanded
+ * @param Board b the position of the leaf
+ * @param int attacker the player that tries to win
+ * @param int defender the attacker's opponent
+ */
+void ProofNumberSolver::Expand(unsigned int n, Board &b, int attacker,
+        int defender){
+    int player = nodes[n].or_node ? attacker : defender;
+
+    std::vector< std::pair<unsigned int, unsigned int> > moves = b.GetPossibleMoves();
+    std::vector< std::pair<unsigned int, unsigned int> >::iterator it;
+
+    std::vector< std::pair<unsigned int, unsigned int> > known;
+
+    for(unsigned int i=0; i<nodes[n].children.size(); i++){
+        known.push_back(nodes[nodes[n].children[i]].move);
+    }
+
+    for(it = moves.begin(); it != moves.end(); it++){
+        if(std::find(known.begin(), known.end(), *it) != known.end()){
+            continue;
+        }
+
+        unsigned int child = NewNode(n, !nodes[n].or_node, *it);
+
+        b.Update(player, it->first, it->second);
+        int winner = b.GetWinner();
+
+        if(winner == attacker){
+            nodes[child].proof = 0;
+            nodes[child].disproof = INF;
+            nodes[child].size = 1;
+        }
+        else if(winner != 0){
+            // a draw is as good as a win for the defender
+            nodes[child].proof = INF;
+            nodes[child].disproof = 0;
+            nodes[child].size = 1;
+        }
+
+        b.Reset(it->first, it->second);
+        nodes[n].children.push_back(child);
+    }
+
+    nodes[n].expanded = true;
+}
+
+/**
+ * Recompute the proof and disproof numbers of an expanded node from its
+ * children, a node that just got solved also gets its solution size
+ *
+ * @param unsigned int n the node that should be updated
+ */
+void ProofNumberSolver::SetNumbers(unsigned int n){
+    Node &node = nodes[n];
+    unsigned int min = INF, sum = 0;
+    unsigned int min_size = INF, sum_size = 0;
+
+    for(unsigned int i=0; i<node.children.size(); i++){
+        const Node &child = nodes[node.children[i]];
+        unsigned int minimized = node.or_node ? child.proof : child.disproof;
+        unsigned int summed = node.or_node ? child.disproof : child.proof;
+
+        if(minimized == 0){
+            min_size = std::min(min_size, child.size);
+        }
+
+        min = std::min(min, minimized);
+        sum = SaturatingAdd(sum, summed);
+        sum_size += child.size;
+    }
+
+    if(node.or_node){
+        node.proof = min;
+        node.disproof = sum;
+    }
+    else{
+        node.proof = sum;
+        node.disproof = min;
+    }
+
+    // one solved child is enough for the player to move, otherwise every
+    // child is part of the solution
+    if(min == 0){
+        node.size = 1 + min_size;
+    }
+    else if(sum == 0){
+        node.size = 1 + sum_size;
+    }
+}
+
+/**
+ * Propagate the numbers of a freshly expanded node up to the root
+ *
+ * @param unsigned int n the expanded node
+ */
+void ProofNumberSolver::UpdateAncestors(unsigned int n){
+    while(true){
+        SetNumbers(n);
+
+        if(n == ROOT){
+            break;
+        }
+
+        n = nodes[n].parent;
+    }
+}
+
+/**
+ * @return unsigned int the number of nodes that can still be allocated
+ */
+unsigned int ProofNumberSolver::FreeSlots(){
+    return free_nodes.size() + (max_nodes - nodes.size());
+}
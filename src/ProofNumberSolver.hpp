@@ -0,0 +1,52 @@
+#ifndef PROOFNUMBERSOLVER_HPP_GUARD
+#define PROOFNUMBERSOLVER_HPP_GUARD
+
+#include <vector>
+
+#include "Board.hpp"
+
+struct SolverResult{
+    enum Status {Proven, Disproven, Unknown};
+
+    Status status;
+    unsigned int solution_size;
+    unsigned int expansions;
+    std::pair<unsigned int, unsigned int> move;
+};
+
+class ProofNumberSolver{
+    public:
+        ProofNumberSolver(unsigned int m, unsigned int e);
+        SolverResult Solve(Board b, int attacker, int defender, int to_move);
+
+    protected:
+        struct Node{
+            unsigned int proof, disproof;
+            unsigned int size;
+            unsigned int parent;
+            unsigned int depth;
+            std::pair<unsigned int, unsigned int> move;
+            bool or_node;
+            bool expanded;
+            std::vector<unsigned int> children;
+        };
+
+        unsigned int NewNode(unsigned int parent, bool or_node,
+                std::pair<unsigned int, unsigned int> move);
+        void FreeChildren(unsigned int n);
+        void Collapse(unsigned int n);
+        void CollectGarbage(unsigned int needed, unsigned int selected);
+        unsigned int SelectMostProving(Board &b, int attacker, int defender);
+        void Expand(unsigned int n, Board &b, int attacker, int defender);
+        void SetNumbers(unsigned int n);
+        void UpdateAncestors(unsigned int n);
+        unsigned int FreeSlots();
+
+    private:
+        unsigned int max_nodes;
+        unsigned int max_expansions;
+        std::vector<Node> nodes;
+        std::vector<unsigned int> free_nodes;
+};
+
+#endif
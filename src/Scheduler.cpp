@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <cmath>
+
+#include "Scheduler.hpp"
+
+/**
+ * Start the worker threads, each of them gets its own copy of the computer
+ * player since a search isn't safe to share between threads
+ *
+ * @param AiPlayer ai the computer player that makes the moves
+ * @param unsigned int t the number of worker threads
+ */
+Scheduler::Scheduler(const AiPlayer &ai, unsigned int t)
+    : players(std::max(t, 1u), ai), pending(0), stopping(false) {
+    for(unsigned int i=0; i<players.size(); i++){
+        threads.push_back(std::thread(&Scheduler::Work, this, i));
+    }
+}
+
+/**
+ * Stop the workers, the searches in progress are finished first
+ */
+Scheduler::~Scheduler(){
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    job_ready.notify_all();
+
+    for(unsigned int i=0; i<threads.size(); i++){
+        threads[i].join();
+    }
+}
+
+/**
+ * Ask for the computer's move on a board
+ *
+ * @param unsigned int board the board's number, used to report the move
+ * @param Board b the board where it's the computer's turn
+ */
+void Scheduler::Submit(unsigned int board, const Board &b){
+    Job job = {board, b, Clock::now()};
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(job);
+        pending++;
+    }
+
+    job_ready.notify_one();
+}
+
+/**
+ * Take the moves found since the last call
+ *
+ * @param bool wait if true, block until at least one move is found, unless
+ * no job is queued or being searched
+ *
+ * @return std::vector<SchedulerResult> the boards and the moves found for them
+ */
+std::vector<SchedulerResult> Scheduler::Collect(bool wait){
+    std::unique_lock<std::mutex> lock(mutex);
+    std::vector<SchedulerResult> x;
+
+    while(wait && results.empty() && pending > 0){
+        result_ready.wait(lock);
+    }
+
+    x.swap(results);
+
+    return x;
+}
+
+/**
+ * Get a percentile of the time a board waited for the computer's moves
+ *
+ * The latency of a move is measured from its submission to the moment the
+ * move was found, so it includes the time spent waiting for a free worker
+ *
+ * @param unsigned int board the board's number
+ * @param float percentile the wanted percentile, between 0 and 100
+ *
+ * @return double the latency in milliseconds (nearest rank), 0 if no move
+ * was made on the board yet
+ */
+double Scheduler::GetLatency(unsigned int board, float percentile){
+    std::vector<double> x;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::map<unsigned int, std::vector<double> >::const_iterator it =
+            latencies.find(board);
+
+        if(it != latencies.end()){
+            x = it->second;
+        }
+    }
+
+    if(x.empty()){
+        return 0;
+    }
+
+    std::sort(x.begin(), x.end());
+
+    unsigned int rank = static_cast<unsigned int>(
+            std::ceil(percentile / 100 * x.size()));
+
+    return x[rank > 0 ? rank - 1 : 0];
+}
+
+/**
+ * The loop of a worker thread
+ *
+ * Jobs are kept in submission order, so the front job is the one of the
+ * board that has waited the longest and it's the one searched next
+ *
+ * @param unsigned int worker the worker's number, selects its computer player
+ */
+void Scheduler::Work(unsigned int worker){
+    sf::Event event;
+
+    while(true){
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while(!stopping && jobs.empty()){
+            job_ready.wait(lock);
+        }
+
+        if(jobs.empty()){
+            return;
+        }
+
+        Job job = jobs.front();
+        jobs.pop_front();
+        lock.unlock();
+
+        SchedulerResult result = {job.board,
+            players[worker].GetInput(event, job.b)};
+        double latency = std::chrono::duration<double, std::milli>(
+                Clock::now() - job.submitted).count();
+
+        lock.lock();
+        results.push_back(result);
+        latencies[job.board].push_back(latency);
+        pending--;
+        lock.unlock();
+
+        result_ready.notify_all();
+    }
+}
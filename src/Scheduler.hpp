@@ -0,0 +1,52 @@
+#ifndef SCHEDULER_HPP_GUARD
+#define SCHEDULER_HPP_GUARD
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Board.hpp"
+#include "AiPlayer.hpp"
+
+struct SchedulerResult{
+    unsigned int board;
+    std::pair<unsigned int, unsigned int> move;
+};
+
+class Scheduler{
+    public:
+        Scheduler(const AiPlayer &ai, unsigned int t);
+        ~Scheduler();
+        void Submit(unsigned int board, const Board &b);
+        std::vector<SchedulerResult> Collect(bool wait);
+        double GetLatency(unsigned int board, float percentile);
+
+    protected:
+        void Work(unsigned int worker);
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        struct Job{
+            unsigned int board;
+            Board b;
+            Clock::time_point submitted;
+        };
+
+        std::vector<AiPlayer> players;
+        std::vector<std::thread> threads;
+        std::deque<Job> jobs;
+        std::vector<SchedulerResult> results;
+        std::map<unsigned int, std::vector<double> > latencies;
+        unsigned int pending;
+        std::mutex mutex;
+        std::condition_variable job_ready;
+        std::condition_variable result_ready;
+        bool stopping;
+};
+
+#endif
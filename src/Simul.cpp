@@ -0,0 +1,89 @@
+#include "Simul.hpp"
+
+/**
+ * @param unsigned int n the number of boards played at once
+ * @param AiPlayer ai the computer player that plays every board
+ * @param int h_id the id of the humans playing against the computer
+ * @param unsigned int t the number of threads searching the computer's moves
+ */
+Simul::Simul(unsigned int n, AiPlayer ai, int h_id, unsigned int t)
+    : boards(n, Board(0, 0)), waiting(n, false), human_id(h_id),
+    ai_id(ai.GetId()), scheduler(ai, t) {
+}
+
+/**
+ * Make a human move on one of the boards
+ *
+ * If the game goes on, the computer's answer is handed to the scheduler and
+ * the board waits for it, see Update()
+ *
+ * @param unsigned int i the board's number
+ * @param unsigned int row the row of the move
+ * @param unsigned int col the column of the move
+ *
+ * @return bool true if the move was made, false if the board is waiting for
+ * the computer, the game is over or the move isn't valid
+ */
+bool Simul::Play(unsigned int i, unsigned int row, unsigned int col){
+    if(waiting[i] || IsOver(i) || !boards[i].Update(human_id, row, col)){
+        return false;
+    }
+
+    if(!IsOver(i)){
+        waiting[i] = true;
+        scheduler.Submit(i, boards[i]);
+    }
+
+    return true;
+}
+
+/**
+ * Make the computer's moves found by the scheduler on their boards
+ *
+ * @param bool wait if true, block until at least one move is found, unless
+ * no board is waiting for the computer
+ *
+ * @return unsigned int the number of moves made
+ */
+unsigned int Simul::Update(bool wait){
+    std::vector<SchedulerResult> results = scheduler.Collect(wait);
+    std::vector<SchedulerResult>::iterator it;
+
+    for(it = results.begin(); it != results.end(); it++){
+        boards[it->board].Update(ai_id, it->move.first, it->move.second);
+        waiting[it->board] = false;
+    }
+
+    return results.size();
+}
+
+/**
+ * @param unsigned int i the board's number
+ *
+ * @return bool true if the board waits for the computer's move
+ */
+bool Simul::IsWaiting(unsigned int i){
+    return waiting[i];
+}
+
+/**
+ * @param unsigned int i the board's number
+ *
+ * @return bool true if the game on the board is over
+ */
+bool Simul::IsOver(unsigned int i){
+    return boards[i].GetWinner() != 0;
+}
+
+/**
+ * Get a percentile of the time the board waited for the computer's moves,
+ * see Scheduler::GetLatency()
+ *
+ * @param unsigned int i the board's number
+ * @param float percentile the wanted percentile, between 0 and 100
+ *
+ * @return double the latency in milliseconds
+ */
+double Simul::GetLatency(unsigned int i, float percentile){
+    return scheduler.GetLatency(i, percentile);
+}
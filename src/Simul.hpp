@@ -0,0 +1,35 @@
+#ifndef SIMUL_HPP_GUARD
+#define SIMUL_HPP_GUARD
+
+#include <vector>
+
+#include "Board.hpp"
+#include "AiPlayer.hpp"
+#include "Scheduler.hpp"
+
+class Simul{
+    public:
+        Simul(unsigned int n, AiPlayer ai, int h_id, unsigned int t);
+        bool Play(unsigned int i, unsigned int row, unsigned int col);
+        unsigned int Update(bool wait);
+        bool IsWaiting(unsigned int i);
+        bool IsOver(unsigned int i);
+        double GetLatency(unsigned int i, float percentile);
+
+        Board& GetBoard(unsigned int i){
+            return boards[i];
+        }
+
+        unsigned int GetCount(){
+            return boards.size();
+        }
+
+    private:
+        std::vector<Board> boards;
+        std::vector<bool> waiting;
+        int human_id;
+        int ai_id;
+        Scheduler scheduler;
+};
+
+#endif
@@ -0,0 +1,95 @@
+#include "ThreatSpaceSearch.hpp"
+
+/**
+ * @param unsigned int d the maximum number of threats in a forcing sequence
+ */
+ThreatSpaceSearch::ThreatSpaceSearch(unsigned int d) : max_depth(d) {
+}
+
+/**
+ * Look for a forcing win of the attacker, the attacker being to move
+ *
+ * Only threat moves of the attacker and the forced blocks of the defender are
+ * explored, so a sequence is found much faster than by a full search, but a
+ * failed search doesn't mean there is no win
+ *
+ * @param Board b the board where the attacker is to move
+ * @param int attacker the player that looks for a forcing win
+ * @param int defender the attacker's opponent
+ * @param std::vector< std::pair<unsigned int, unsigned int> > sequence where
+ * the forcing sequence is stored: attacker moves alternating with the
+ * defender's blocks, ending with a winning move or a double threat
+ *
+ * @return bool true if a forcing sequence was found, else false
+ */
+bool ThreatSpaceSearch::Search(Board b, int attacker, int defender,
+        std::vector< std::pair<unsigned int, unsigned int> > &sequence){
+    sequence.clear();
+
+    return Attack(b, attacker, defender, 0, sequence);
+}
+
+/**
+ * Try every threat of the attacker and the defender's only answer to it
+ *
+ * @param Board b the board where the attacker is to move
+ * @param int attacker the player that looks for a forcing win
+ * @param int defender the attacker's opponent
+ * @param unsigned int depth the number of threats already made
+ * @param std::vector< std::pair<unsigned int, unsigned int> > sequence the
+ * moves made so far, the rest of the sequence is appended to it
+ *
+ * @return bool true if a forcing sequence was found, else false
+ */
+bool ThreatSpaceSearch::Attack(Board &b, int attacker, int defender,
+        unsigned int depth,
+        std::vector< std::pair<unsigned int, unsigned int> > &sequence){
+    std::vector< std::pair<unsigned int, unsigned int> > wins = b.GetThreats(attacker);
+
+    if(!wins.empty()){
+        sequence.push_back(wins[0]);
+        return true;
+    }
+
+    // the attacker would have to defend, the sequence isn't forcing anymore
+    if(depth >= max_depth || !b.GetThreats(defender).empty()){
+        return false;
+    }
+
+    std::vector< std::pair<unsigned int, unsigned int> > moves = b.GetPossibleMoves();
+    std::vector< std::pair<unsigned int, unsigned int> >::iterator it;
+
+    for(it = moves.begin(); it != moves.end(); it++){
+        b.Update(attacker, it->first, it->second);
+        std::vector< std::pair<unsigned int, unsigned int> > threats = b.GetThreats(attacker);
+
+        if(threats.size() >= 2){
+            // the defender can block only one of the threats
+            b.Reset(it->first, it->second);
+            sequence.push_back(*it);
+            return true;
+        }
+
+        if(threats.size() == 1){
+            b.Update(defender, threats[0].first, threats[0].second);
+            sequence.push_back(*it);
+            sequence.push_back(threats[0]);
+
+            bool found = Attack(b, attacker, defender, depth + 1, sequence);
+
+            b.Reset(threats[0].first, threats[0].second);
+
+            if(found){
+                b.Reset(it->first, it->second);
+                return true;
+            }
+
+            sequence.pop_back();
+            sequence.pop_back();
+        }
+
+        b.Reset(it->first, it->second);
+    }
+
+    return false;
+}
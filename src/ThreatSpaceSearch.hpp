@@ -0,0 +1,22 @@
+#ifndef THREATSPACESEARCH_HPP_GUARD
+#define THREATSPACESEARCH_HPP_GUARD
+
+#include <vector>
+
+#include "Board.hpp"
+
+class ThreatSpaceSearch{
+    public:
+        ThreatSpaceSearch(unsigned int d);
+        bool Search(Board b, int attacker, int defender,
+                std::vector< std::pair<unsigned int, unsigned int> > &sequence);
+
+    protected:
+        bool Attack(Board &b, int attacker, int defender, unsigned int depth,
+                std::vector< std::pair<unsigned int, unsigned int> > &sequence);
+
+    private:
+        unsigned int max_depth;
+};
+
+#endif
@@ -0,0 +1,136 @@
+#include "Helpers.hpp"
+#include "Trainer.hpp"
+
+Trainer::Trainer(Evaluator &e, float a, float eps)
+    : evaluator(e), alpha(a), epsilon(eps) {
+}
+
+/**
+ * Train the evaluator by letting it play against itself
+ *
+ * @param unsigned int games the number of self-play games
+ */
+void Trainer::Train(unsigned int games){
+    for(unsigned int i=0; i<games; i++){
+        PlayGame();
+    }
+}
+
+/**
+ * Play a single self-play game and update the evaluator along the way
+ *
+ * This is TD(0) learning on afterstates: each player's previous afterstate
+ * is moved towards the value of its next afterstate, or towards the real
+ * outcome once the game is over. After an exploratory move the player's
+ * previous afterstate isn't updated, the greedy policy wouldn't get there
+ */
+void Trainer::PlayGame(){
+    Board b(0, 0);
+    Board last[2] = {b, b};
+    bool has_last[2] = {false, false};
+    int players[2] = {1, 2};
+    int turn = probability(50) ? 0 : 1;
+
+    while(true){
+        int id = players[turn];
+        int o_id = players[1-turn];
+
+        bool explored;
+        std::pair<unsigned int, unsigned int> move = ChooseMove(b, id, o_id,
+                explored);
+        b.Update(id, move.first, move.second);
+
+        int winner = b.GetWinner();
+
+        if(winner != 0){
+            //the game is over, both players learn the real outcome
+            for(int i=0; i<2; i++){
+                if(has_last[i] && !(i == turn && explored)){
+                    evaluator.Update(last[i], players[i], players[1-i],
+                            GetOutcome(winner, players[i]), alpha);
+                }
+            }
+
+            return;
+        }
+
+        if(has_last[turn] && !explored){
+            evaluator.Update(last[turn], id, o_id,
+                    evaluator.Evaluate(b, id, o_id), alpha);
+        }
+
+        last[turn] = b;
+        has_last[turn] = true;
+        turn = 1 - turn;
+    }
+}
+
+/**
+ * Choose a move for the given player, epsilon-greedy on the evaluator
+ *
+ * @param Board b the current board
+ * @param int id the player that should move
+ * @param int o_id the opponent's id
+ * @param bool explored set to true if a random move was chosen, else false
+ *
+ * @return std::pair<unsigned int, unsigned int> the chosen move, composed of
+ * the row and the column
+ */
+std::pair<unsigned int, unsigned int> Trainer::ChooseMove(Board b, int id,
+        int o_id, bool &explored){
+    std::vector< std::pair<unsigned int, unsigned int> > moves = b.GetPossibleMoves();
+    std::vector< std::pair<unsigned int, unsigned int> >::iterator it;
+
+    // explore a random move every now and then
+    explored = probability(epsilon * 100);
+
+    if(explored){
+        return moves[sf::Randomizer::Random(0, moves.size() - 1)];
+    }
+
+    float best_score = -2;
+    std::pair<unsigned int, unsigned int> best_move = moves[0];
+
+    for(it = moves.begin(); it != moves.end(); it++){
+        float score;
+
+        b.Update(id, it->first, it->second);
+        int winner = b.GetWinner();
+
+        if(winner != 0){
+            score = GetOutcome(winner, id);
+        }
+        else{
+            score = evaluator.Evaluate(b, id, o_id);
+        }
+
+        b.Reset(it->first, it->second);
+
+        if(score > best_score){
+            best_score = score;
+            best_move = *it;
+        }
+    }
+
+    return best_move;
+}
+
+/**
+ * Get the outcome of a finished game from a player's point of view
+ *
+ * @param int winner the winner as returned by Board::GetWinner()
+ * @param int id the player whose outcome is wanted
+ *
+ * @return float 1 if the player won, 0 for a draw, else -1
+ */
+float Trainer::GetOutcome(int winner, int id){
+    if(winner == id){
+        return 1;
+    }
+
+    if(winner == -1){
+        return 0;
+    }
+
+    return -1;
+}
@@ -0,0 +1,24 @@
+#ifndef TRAINER_HPP_GUARD
+#define TRAINER_HPP_GUARD
+
+#include "Board.hpp"
+#include "Evaluator.hpp"
+
+class Trainer{
+    public:
+        Trainer(Evaluator &e, float a, float eps);
+        void Train(unsigned int games);
+
+    protected:
+        void PlayGame();
+        std::pair<unsigned int, unsigned int> ChooseMove(Board b, int id,
+                int o_id, bool &explored);
+        float GetOutcome(int winner, int id);
+
+    private:
+        Evaluator &evaluator;
+        float alpha;
+        float epsilon;
+};
+
+#endif
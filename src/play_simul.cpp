@@ -0,0 +1,63 @@
+#include <cstdlib>
+#include <iostream>
+
+#include "Simul.hpp"
+
+/**
+ * Headless simultaneous play: the computer plays many boards at once against
+ * random opponents and reports how long each board waited for its moves
+ *
+ * Usage: simul.exe [boards] [threads]
+ */
+int main(int argc, char *argv[]){
+    unsigned int count = 20;
+    unsigned int threads = 4;
+
+    if(argc > 1){
+        count = std::atoi(argv[1]);
+    }
+
+    if(argc > 2){
+        threads = std::atoi(argv[2]);
+    }
+
+    AiPlayer ai(2, 1, 0, 5);
+
+    Simul simul(count, ai, 1, threads);
+    unsigned int waiting = 0;
+
+    do{
+        for(unsigned int i=0; i<simul.GetCount(); i++){
+            if(!simul.IsOver(i) && !simul.IsWaiting(i)){
+                std::vector< std::pair<unsigned int, unsigned int> > moves = simul.GetBoard(i).GetPossibleMoves();
+                std::pair<unsigned int, unsigned int> move =
+                    moves[sf::Randomizer::Random(0, moves.size() - 1)];
+
+                simul.Play(i, move.first, move.second);
+            }
+        }
+
+        //the random move may have ended the game, then nothing is waiting
+        waiting = 0;
+
+        for(unsigned int i=0; i<simul.GetCount(); i++){
+            if(simul.IsWaiting(i)){
+                waiting++;
+            }
+        }
+
+        if(waiting > 0){
+            simul.Update(true);
+        }
+    }while(waiting > 0);
+
+    const char *outcomes[] = {"draw", "", "lost", "won"};
+
+    for(unsigned int i=0; i<simul.GetCount(); i++){
+        std::cout << "board " << i << ": computer "
+            << outcomes[simul.GetBoard(i).GetWinner() + 1]
+            << ", latency p50 " << simul.GetLatency(i, 50)
+            << " ms, p90 " << simul.GetLatency(i, 90)
+            << " ms, p99 " << simul.GetLatency(i, 99) << " ms" << std::endl;
+    }
+}
@@ -0,0 +1,122 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "Board.hpp"
+#include "ProofNumberSolver.hpp"
+
+/**
+ * Parse a budget given on the command line
+ *
+ * @param char* text the argument
+ * @param unsigned int value where the parsed budget is stored
+ *
+ * @return bool true if the argument is a positive number that fits an
+ * unsigned int, else false
+ */
+bool ParseBudget(const char *text, unsigned int &value){
+    char *end;
+    unsigned long x;
+
+    if(text[0] < '0' || text[0] > '9'){
+        return false;
+    }
+
+    x = std::strtoul(text, &end, 10);
+
+    if(*end != '\0' || x == 0 || x > 0xFFFFFFFFul){
+        return false;
+    }
+
+    value = x;
+    return true;
+}
+
+/**
+ * Headless proof-number solver for a position
+ *
+ * Usage: solver.exe [position] [nodes] [expansions]
+ *
+ * The position lists the 9 cells row by row: x, o or . for an empty cell,
+ * the player to move is deduced from the number of marks (x moves first).
+ * Both "x wins" and "o wins" are tried, so the game value is reported
+ */
+int main(int argc, char *argv[]){
+    std::string position = ".........";
+    unsigned int nodes = 1000000;
+    unsigned int expansions = 1000000;
+
+    if(argc > 1){
+        position = argv[1];
+    }
+
+    if(argc > 2 && !ParseBudget(argv[2], nodes)){
+        std::cerr << "The nodes should be a positive number" << std::endl;
+        return 1;
+    }
+
+    if(argc > 3 && !ParseBudget(argv[3], expansions)){
+        std::cerr << "The expansions should be a positive number" << std::endl;
+        return 1;
+    }
+
+    if(position.size() != 9){
+        std::cerr << "The position should have 9 cells" << std::endl;
+        return 1;
+    }
+
+    Board b(0, 0);
+    Board marked[3] = {b, b, b};
+    int marks = 0;
+
+    for(unsigned int i=0; i<position.size(); i++){
+        if(position[i] != 'x' && position[i] != 'o' && position[i] != '.'){
+            std::cerr << "The cells should be x, o or ." << std::endl;
+            return 1;
+        }
+
+        int id = position[i] == 'x' ? 1 : position[i] == 'o' ? 2 : 0;
+
+        if(id != 0){
+            b.Update(id, i/3 + 1, i%3 + 1);
+            marked[id].Update(id, i/3 + 1, i%3 + 1);
+            marks += id == 1 ? 1 : -1;
+        }
+    }
+
+    //x moves first, so it has as many marks as o or one more
+    if(marks != 0 && marks != 1){
+        std::cerr << "x should have as many marks as o or one more"
+            << std::endl;
+        return 1;
+    }
+
+    //the game stops at the first line, so both can't have one
+    if(marked[1].GetWinner() == 1 && marked[2].GetWinner() == 2){
+        std::cerr << "x and o can't both have three in a row" << std::endl;
+        return 1;
+    }
+
+    int to_move = marks > 0 ? 2 : 1;
+    const char *names[] = {"", "x", "o"};
+    const char *statuses[] = {"proven", "disproven", "unknown"};
+
+    ProofNumberSolver solver(nodes, expansions);
+
+    for(int attacker=1; attacker<=2; attacker++){
+        SolverResult result = solver.Solve(b, attacker, 3 - attacker,
+                to_move);
+
+        std::cout << names[attacker] << " wins: "
+            << statuses[result.status]
+            << ", solution size " << result.solution_size
+            << ", " << result.expansions << " expansions";
+
+        if(result.move.first != 0){
+            std::cout << ", " << names[to_move] << " plays ("
+                << result.move.first << ", " << result.move.second << ")";
+        }
+
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,37 @@
+#include <cstdlib>
+#include <iostream>
+
+#include "Evaluator.hpp"
+#include "Trainer.hpp"
+
+/**
+ * Headless training of the computer player's evaluator
+ *
+ * Usage: trainer.exe [games] [weights file]
+ */
+int main(int argc, char *argv[]){
+    unsigned int games = 100000;
+    std::string file = "tic-tac-toe.weights";
+
+    if(argc > 1){
+        games = std::atoi(argv[1]);
+    }
+
+    if(argc > 2){
+        file = argv[2];
+    }
+
+    Evaluator evaluator;
+    evaluator.Load(file);
+
+    Trainer trainer(evaluator, 0.01f, 0.1f);
+    trainer.Train(games);
+
+    if(!evaluator.Save(file)){
+        std::cerr << "Could not save the weights to " << file << std::endl;
+        return 1;
+    }
+
+    std::cout << "Trained " << games << " games, weights saved to " << file
+        << std::endl;
+}